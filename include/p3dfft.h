@@ -24,6 +24,45 @@
 
 #define FORT_MOD_NAME(NAME) NAME
 
+/* Phases of the transforms, indexed from 0 in the arrays of
+   Cp3dfft_instr_get and Cp3dfft_instr_summary */
+#define P3DFFT_NPHASES 7
+#define P3DFFT_PHASE_PACK 0
+#define P3DFFT_PHASE_EXCHANGE 1
+#define P3DFFT_PHASE_UNPACK 2
+#define P3DFFT_PHASE_FFT_X 3
+#define P3DFFT_PHASE_FFT_Y 4
+#define P3DFFT_PHASE_FFT_Z 5
+#define P3DFFT_PHASE_REORDER 6
+
+/* Results of Cp3dfft_dryrun, indexed from 0 */
+#define P3DFFT_NPRED 20
+#define P3DFFT_PRED_NM 0
+#define P3DFFT_PRED_PADI 1
+#define P3DFFT_PRED_MEMSIZE 2
+#define P3DFFT_PRED_BUF_BYTES 5
+#define P3DFFT_PRED_PENCIL 6
+#define P3DFFT_PRED_XY_MSGS 9
+#define P3DFFT_PRED_XY_BYTES 10
+#define P3DFFT_PRED_XY_MAXMSG 11
+#define P3DFFT_PRED_YZ_MSGS 12
+#define P3DFFT_PRED_YZ_BYTES 13
+#define P3DFFT_PRED_YZ_MAXMSG 14
+#define P3DFFT_PRED_FLOPS 15
+#define P3DFFT_PRED_T_EXCHANGE 16
+#define P3DFFT_PRED_T_PACK 17
+#define P3DFFT_PRED_T_FFT 18
+#define P3DFFT_PRED_TIME 19
+
+/* Categories of memory held by the library, indexed from 0 in the
+   arrays of Cp3dfft_get_mem */
+#define P3DFFT_NMEM 5
+#define P3DFFT_MEM_BUFFERS 0
+#define P3DFFT_MEM_TABLES 1
+#define P3DFFT_MEM_PLANS 2
+#define P3DFFT_MEM_OTHER 3
+#define P3DFFT_MEM_TOTAL 4
+
 #ifdef IBM
 
 #define FORTNAME(NAME) NAME
@@ -56,42 +95,196 @@ extern "C"
 {
 #endif
 
-extern void FORT_MOD_NAME(p3dfft_setup)(int *dims,int *nx,int *ny,int *nz, int * comm, int *nxc, int *nyc, int *nzc, int *ow, int *memsize);
+extern void FORT_MOD_NAME(p3dfft_setup)(int *dims,int *nx,int *ny,int *nz, int * comm, int *nxc, int *nyc, int *nzc, int *ow, int *memsize, long long *worksize);
 extern void FORT_MOD_NAME(p3dfft_get_dims)(int *,int *,int *,int *);
 extern void FORT_MOD_NAME(get_timers)(double *timers);
 extern void FORT_MOD_NAME(set_timers)();
+extern void FORT_MOD_NAME(p3dfft_instr_reset)();
+extern void FORT_MOD_NAME(p3dfft_instr_get)(double *time,long long *calls,long long *bytes,long long *nvars);
+extern void FORT_MOD_NAME(p3dfft_instr_summary)(double *stats);
+extern void FORT_MOD_NAME(p3dfft_instr_print)();
+extern void FORT_MOD_NAME(p3dfft_trace_start)(int *nevents);
+extern void FORT_MOD_NAME(p3dfft_trace_stop)();
+extern void FORT_MOD_NAME(p3dfft_trace_dump)(const char *prefix);
+extern void FORT_MOD_NAME(p3dfft_bench_kernels)(int *nx,int *ny,int *nz,int *dims,int *nv,int *nrep,int *blocks,int *nblocks);
+extern void FORT_MOD_NAME(p3dfft_dryrun)(int *dims,int *nx,int *ny,int *nz,int *nxc,int *nyc,int *nzc,int *nv,double *pred);
+extern void FORT_MOD_NAME(p3dfft_set_model)(double *par);
+extern void FORT_MOD_NAME(p3dfft_get_model)(double *par);
+extern void FORT_MOD_NAME(p3dfft_fit_model)(int *n,double *pred,double *meas,double *par);
+extern void FORT_MOD_NAME(p3dfft_get_mem)(long long *cur,long long *peak);
+extern void FORT_MOD_NAME(p3dfft_reset_mem_peak)();
+extern void FORT_MOD_NAME(p3dfft_set_mem_limit)(long long *limit,int *fail);
+extern void FORT_MOD_NAME(p3dfft_mem_print)();
 
 #ifndef SINGLE_PREC
 extern void FORT_MOD_NAME(p3dfft_ftran_r2c)(double *A,double *B, unsigned char *op);
 extern void FORT_MOD_NAME(p3dfft_btran_c2r)(double *A,double *B, unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_btran_c2r_deriv)(double *A,double *B, unsigned char *op, int *idir);
+extern void FORT_MOD_NAME(p3dfft_solve_helmholtz)(double *alpha,double *beta,double *A,double *B);
+extern void FORT_MOD_NAME(p3dfft_convolve_many)(double *A,int *dim_in,int *nin,double *B,int *dim_out,int *nout,
+		void (*prod)(int *n,int *nin,double *U,int *ldu,int *k,double *W), unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2c_diag)(double *A,double *B, unsigned char *op,int *kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void FORT_MOD_NAME(p3dfft_spec_diag)(double *B,int *kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2c_xy)(double *A,double *B);
+extern void FORT_MOD_NAME(p3dfft_btran_c2r_xy)(double *A,double *B);
+extern void FORT_MOD_NAME(p3dfft_ftran_c2c)(double *A,double *B);
+extern void FORT_MOD_NAME(p3dfft_btran_c2c)(double *A,double *B);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2r_x)(double *A,double *B, unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_btran_r2r_x)(double *A,double *B, unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_ghost_begin)(double *A);
+extern void FORT_MOD_NAME(p3dfft_ghost_end)(double *A);
+extern void FORT_MOD_NAME(p3dfft_update_ghosts)(double *A);
+extern void FORT_MOD_NAME(p3dfft_gather_box)(double *A,int *base,int *size,double *B,int *recv);
+extern void FORT_MOD_NAME(p3dfft_scatter_box)(double *B,int *base,int *size,double *A,int *root);
+extern void FORT_MOD_NAME(p3dfft_gather_box_spec)(double *A,int *base,int *size,double *B,int *recv);
+extern void FORT_MOD_NAME(p3dfft_scatter_box_spec)(double *B,int *base,int *size,double *A,int *root);
+extern void FORT_MOD_NAME(p3dfft_write_ckpt)(const char *fname,double *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_read_ckpt)(const char *fname,double *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_write_ckpt_spec)(const char *fname,double *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_read_ckpt_spec)(const char *fname,double *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_write_ckpt_trunc)(const char *fname,double *A,int *nv,int *kmax,int *k2max);
+extern void FORT_MOD_NAME(p3dfft_read_ckpt_trunc)(const char *fname,double *A,int *nv);
 #else
 extern void FORT_MOD_NAME(p3dfft_ftran_r2c)(float *A,float *B, unsigned char *op);
 extern void FORT_MOD_NAME(p3dfft_btran_c2r)(float *A,float *B, unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_btran_c2r_deriv)(float *A,float *B, unsigned char *op, int *idir);
+extern void FORT_MOD_NAME(p3dfft_solve_helmholtz)(float *alpha,float *beta,float *A,float *B);
+extern void FORT_MOD_NAME(p3dfft_convolve_many)(float *A,int *dim_in,int *nin,float *B,int *dim_out,int *nout,
+		void (*prod)(int *n,int *nin,float *U,int *ldu,int *k,float *W), unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2c_diag)(float *A,float *B, unsigned char *op,int *kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void FORT_MOD_NAME(p3dfft_spec_diag)(float *B,int *kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2c_xy)(float *A,float *B);
+extern void FORT_MOD_NAME(p3dfft_btran_c2r_xy)(float *A,float *B);
+extern void FORT_MOD_NAME(p3dfft_ftran_c2c)(float *A,float *B);
+extern void FORT_MOD_NAME(p3dfft_btran_c2c)(float *A,float *B);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2r_x)(float *A,float *B, unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_btran_r2r_x)(float *A,float *B, unsigned char *op);
+extern void FORT_MOD_NAME(p3dfft_ghost_begin)(float *A);
+extern void FORT_MOD_NAME(p3dfft_ghost_end)(float *A);
+extern void FORT_MOD_NAME(p3dfft_update_ghosts)(float *A);
+extern void FORT_MOD_NAME(p3dfft_gather_box)(float *A,int *base,int *size,float *B,int *recv);
+extern void FORT_MOD_NAME(p3dfft_scatter_box)(float *B,int *base,int *size,float *A,int *root);
+extern void FORT_MOD_NAME(p3dfft_gather_box_spec)(float *A,int *base,int *size,float *B,int *recv);
+extern void FORT_MOD_NAME(p3dfft_scatter_box_spec)(float *B,int *base,int *size,float *A,int *root);
+extern void FORT_MOD_NAME(p3dfft_write_ckpt)(const char *fname,float *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_read_ckpt)(const char *fname,float *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_write_ckpt_spec)(const char *fname,float *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_read_ckpt_spec)(const char *fname,float *A,int *nv);
+extern void FORT_MOD_NAME(p3dfft_write_ckpt_trunc)(const char *fname,float *A,int *nv,int *kmax,int *k2max);
+extern void FORT_MOD_NAME(p3dfft_read_ckpt_trunc)(const char *fname,float *A,int *nv);
 #endif
 
 extern void FORT_MOD_NAME(p3dfft_clean)();
-
-
-extern void Cp3dfft_setup(int *dims,int nx,int ny,int nz,int comm, int nxc,int nyc, int nzc, int ovewrite, int *memsize);
+extern void FORT_MOD_NAME(p3dfft_set_split)(int *dims,int *iisz,int *jisz,int *jjsz,int *kjsz);
+extern void FORT_MOD_NAME(p3dfft_set_decomp)(int *mode);
+extern void FORT_MOD_NAME(p3dfft_set_prune)(int *mode);
+extern void FORT_MOD_NAME(p3dfft_init_ghosts)(int *gw,int *corners);
+extern void FORT_MOD_NAME(p3dfft_get_ghost_dims)(int *,int *,int *);
+extern void FORT_MOD_NAME(p3dfft_owner_points)(int *pts,int *n,int *conf,int *owner);
+extern void FORT_MOD_NAME(p3dfft_owner_boxes)(int *boxes,int *n,int *conf,int *parts,int *maxparts,int *nparts);
+extern void FORT_MOD_NAME(p3dfft_set_io_hints)(int *cb_nodes);
+extern void FORT_MOD_NAME(p3dfft_ftran_r2c_ooc)(const char *infile,const char *outfile,const char *scratch,int *nx,int *ny,int *nz,int *comm,int *mem_mb);
+extern void FORT_MOD_NAME(p3dfft_btran_c2r_ooc)(const char *infile,const char *outfile,const char *scratch,int *nx,int *ny,int *nz,int *comm,int *mem_mb);
+
+
+/* worksize, if not NULL, returns the bytes of work buffers held by the
+   library on this task */
+extern void Cp3dfft_setup(int *dims,int nx,int ny,int nz,int comm, int nxc,int nyc, int nzc, int ovewrite, int *memsize, long long *worksize);
 extern void Cp3dfft_clean();
 
 extern void Cp3dfft_get_dims(int *,int *,int *,int );
+extern void Cp3dfft_set_split(int *dims,int *iisz,int *jisz,int *jjsz,int *kjsz);
+extern void Cp3dfft_set_decomp(int mode);
+extern void Cp3dfft_set_prune(int mode);
+extern void Cp3dfft_init_ghosts(int gw,int corners);
+extern void Cp3dfft_get_ghost_dims(int *,int *,int *);
+extern void Cp3dfft_owner_points(int *pts,int n,int conf,int *owner);
+extern void Cp3dfft_owner_boxes(int *boxes,int n,int conf,int *parts,int maxparts,int *nparts);
+extern void Cp3dfft_set_io_hints(int cb_nodes);
+extern void Cp3dfft_ftran_r2c_ooc(const char *infile,const char *outfile,const char *scratch,int nx,int ny,int nz,int comm,int mem_mb);
+extern void Cp3dfft_btran_c2r_ooc(const char *infile,const char *outfile,const char *scratch,int nx,int ny,int nz,int comm,int mem_mb);
 
 #ifndef SINGLE_PREC
 extern void Cp3dfft_ftran_r2c(double *A,double *B, unsigned char *op);
 extern void Cp3dfft_btran_c2r(double *A,double *B, unsigned char *op);
+extern void Cp3dfft_btran_c2r_deriv(double *A,double *B, unsigned char *op, int idir);
+extern void Cp3dfft_solve_helmholtz(double alpha,double beta,double *A,double *B);
+extern void Cp3dfft_convolve_many(double *A,int dim_in,int nin,double *B,int dim_out,int nout,
+		void (*prod)(int *n,int *nin,double *U,int *ldu,int *k,double *W), unsigned char *op);
+extern void Cp3dfft_ftran_r2c_diag(double *A,double *B, unsigned char *op,int kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void Cp3dfft_spec_diag(double *B,int kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void Cp3dfft_ftran_r2c_xy(double *A,double *B);
+extern void Cp3dfft_btran_c2r_xy(double *A,double *B);
+extern void Cp3dfft_ftran_c2c(double *A,double *B);
+extern void Cp3dfft_btran_c2c(double *A,double *B);
+extern void Cp3dfft_ftran_r2r_x(double *A,double *B, unsigned char *op);
+extern void Cp3dfft_btran_r2r_x(double *A,double *B, unsigned char *op);
+extern void Cp3dfft_ghost_begin(double *A);
+extern void Cp3dfft_ghost_end(double *A);
+extern void Cp3dfft_update_ghosts(double *A);
+extern void Cp3dfft_gather_box(double *A,int *base,int *size,double *B,int recv);
+extern void Cp3dfft_scatter_box(double *B,int *base,int *size,double *A,int root);
+extern void Cp3dfft_gather_box_spec(double *A,int *base,int *size,double *B,int recv);
+extern void Cp3dfft_scatter_box_spec(double *B,int *base,int *size,double *A,int root);
+extern void Cp3dfft_write_ckpt(const char *fname,double *A,int nv);
+extern void Cp3dfft_read_ckpt(const char *fname,double *A,int nv);
+extern void Cp3dfft_write_ckpt_spec(const char *fname,double *A,int nv);
+extern void Cp3dfft_read_ckpt_spec(const char *fname,double *A,int nv);
+extern void Cp3dfft_write_ckpt_trunc(const char *fname,double *A,int nv,int *kmax,int k2max);
+extern void Cp3dfft_read_ckpt_trunc(const char *fname,double *A,int nv);
 #else
 extern void Cp3dfft_ftran_r2c(float *A,float *B, unsigned char *op);
 extern void Cp3dfft_btran_c2r(float *A,float *B, unsigned char *op);
+extern void Cp3dfft_btran_c2r_deriv(float *A,float *B, unsigned char *op, int idir);
+extern void Cp3dfft_solve_helmholtz(float alpha,float beta,float *A,float *B);
+extern void Cp3dfft_convolve_many(float *A,int dim_in,int nin,float *B,int dim_out,int nout,
+		void (*prod)(int *n,int *nin,float *U,int *ldu,int *k,float *W), unsigned char *op);
+extern void Cp3dfft_ftran_r2c_diag(float *A,float *B, unsigned char *op,int kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void Cp3dfft_spec_diag(float *B,int kmax,double *E,double *energy,double *maxabs,int *nnan);
+extern void Cp3dfft_ftran_r2c_xy(float *A,float *B);
+extern void Cp3dfft_btran_c2r_xy(float *A,float *B);
+extern void Cp3dfft_ftran_c2c(float *A,float *B);
+extern void Cp3dfft_btran_c2c(float *A,float *B);
+extern void Cp3dfft_ftran_r2r_x(float *A,float *B, unsigned char *op);
+extern void Cp3dfft_btran_r2r_x(float *A,float *B, unsigned char *op);
+extern void Cp3dfft_ghost_begin(float *A);
+extern void Cp3dfft_ghost_end(float *A);
+extern void Cp3dfft_update_ghosts(float *A);
+extern void Cp3dfft_gather_box(float *A,int *base,int *size,float *B,int recv);
+extern void Cp3dfft_scatter_box(float *B,int *base,int *size,float *A,int root);
+extern void Cp3dfft_gather_box_spec(float *A,int *base,int *size,float *B,int recv);
+extern void Cp3dfft_scatter_box_spec(float *B,int *base,int *size,float *A,int root);
+extern void Cp3dfft_write_ckpt(const char *fname,float *A,int nv);
+extern void Cp3dfft_read_ckpt(const char *fname,float *A,int nv);
+extern void Cp3dfft_write_ckpt_spec(const char *fname,float *A,int nv);
+extern void Cp3dfft_read_ckpt_spec(const char *fname,float *A,int nv);
+extern void Cp3dfft_write_ckpt_trunc(const char *fname,float *A,int nv,int *kmax,int k2max);
+extern void Cp3dfft_read_ckpt_trunc(const char *fname,float *A,int nv);
 #endif
 
 extern void Cget_timers(double *timers);
 extern void Cset_timers();
-
-
-inline void Cp3dfft_setup(int *dims,int nx,int ny,int nz, int comm, int nxc, int nyc, int nzc, int overwrite, int * memsize)
+extern void Cp3dfft_instr_reset();
+extern void Cp3dfft_instr_get(double *time,long long *calls,long long *bytes,long long *nvars);
+extern void Cp3dfft_instr_summary(double *stats);
+extern void Cp3dfft_instr_print();
+extern void Cp3dfft_trace_start(int nevents);
+extern void Cp3dfft_trace_stop();
+extern void Cp3dfft_trace_dump(const char *prefix);
+extern void Cp3dfft_bench_kernels(int nx,int ny,int nz,int *dims,int nv,int nrep,int *blocks,int nblocks);
+extern void Cp3dfft_dryrun(int *dims,int nx,int ny,int nz,int nxc,int nyc,int nzc,int nv,double *pred);
+extern void Cp3dfft_set_model(double *par);
+extern void Cp3dfft_get_model(double *par);
+extern void Cp3dfft_fit_model(int n,double *pred,double *meas,double *par);
+extern void Cp3dfft_get_mem(long long *cur,long long *peak);
+extern void Cp3dfft_reset_mem_peak();
+extern void Cp3dfft_set_mem_limit(long long limit,int fail);
+extern void Cp3dfft_mem_print();
+
+
+inline void Cp3dfft_setup(int *dims,int nx,int ny,int nz, int comm, int nxc, int nyc, int nzc, int overwrite, int * memsize, long long *worksize)
 {
-  FORT_MOD_NAME(p3dfft_setup)(dims,&nx,&ny,&nz,&comm, &nxc, &nyc, &nzc, &overwrite,memsize);
+  FORT_MOD_NAME(p3dfft_setup)(dims,&nx,&ny,&nz,&comm, &nxc, &nyc, &nzc, &overwrite,memsize,worksize);
 }
 
 inline void Cp3dfft_clean()
@@ -104,6 +297,56 @@ inline void Cp3dfft_get_dims(int *start,int *end,int *size,int conf)
   FORT_MOD_NAME(p3dfft_get_dims)(start,end,size,&conf);
 }
 
+inline void Cp3dfft_set_split(int *dims,int *iisz,int *jisz,int *jjsz,int *kjsz)
+{
+  FORT_MOD_NAME(p3dfft_set_split)(dims,iisz,jisz,jjsz,kjsz);
+}
+
+inline void Cp3dfft_set_decomp(int mode)
+{
+  FORT_MOD_NAME(p3dfft_set_decomp)(&mode);
+}
+
+inline void Cp3dfft_set_prune(int mode)
+{
+  FORT_MOD_NAME(p3dfft_set_prune)(&mode);
+}
+
+inline void Cp3dfft_init_ghosts(int gw,int corners)
+{
+  FORT_MOD_NAME(p3dfft_init_ghosts)(&gw,&corners);
+}
+
+inline void Cp3dfft_get_ghost_dims(int *start,int *end,int *size)
+{
+  FORT_MOD_NAME(p3dfft_get_ghost_dims)(start,end,size);
+}
+
+inline void Cp3dfft_owner_points(int *pts,int n,int conf,int *owner)
+{
+  FORT_MOD_NAME(p3dfft_owner_points)(pts,&n,&conf,owner);
+}
+
+inline void Cp3dfft_owner_boxes(int *boxes,int n,int conf,int *parts,int maxparts,int *nparts)
+{
+  FORT_MOD_NAME(p3dfft_owner_boxes)(boxes,&n,&conf,parts,&maxparts,nparts);
+}
+
+inline void Cp3dfft_set_io_hints(int cb_nodes)
+{
+  FORT_MOD_NAME(p3dfft_set_io_hints)(&cb_nodes);
+}
+
+inline void Cp3dfft_ftran_r2c_ooc(const char *infile,const char *outfile,const char *scratch,int nx,int ny,int nz,int comm,int mem_mb)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2c_ooc)(infile,outfile,scratch,&nx,&ny,&nz,&comm,&mem_mb);
+}
+
+inline void Cp3dfft_btran_c2r_ooc(const char *infile,const char *outfile,const char *scratch,int nx,int ny,int nz,int comm,int mem_mb)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2r_ooc)(infile,outfile,scratch,&nx,&ny,&nz,&comm,&mem_mb);
+}
+
 inline void Cget_timers(double *timers)
 {
   FORT_MOD_NAME(get_timers)(timers);
@@ -114,6 +357,86 @@ inline void Cset_timers()
   FORT_MOD_NAME(set_timers)();
 }
 
+inline void Cp3dfft_instr_reset()
+{
+  FORT_MOD_NAME(p3dfft_instr_reset)();
+}
+
+inline void Cp3dfft_instr_get(double *time,long long *calls,long long *bytes,long long *nvars)
+{
+  FORT_MOD_NAME(p3dfft_instr_get)(time,calls,bytes,nvars);
+}
+
+inline void Cp3dfft_instr_summary(double *stats)
+{
+  FORT_MOD_NAME(p3dfft_instr_summary)(stats);
+}
+
+inline void Cp3dfft_instr_print()
+{
+  FORT_MOD_NAME(p3dfft_instr_print)();
+}
+
+inline void Cp3dfft_trace_start(int nevents)
+{
+  FORT_MOD_NAME(p3dfft_trace_start)(&nevents);
+}
+
+inline void Cp3dfft_trace_stop()
+{
+  FORT_MOD_NAME(p3dfft_trace_stop)();
+}
+
+inline void Cp3dfft_trace_dump(const char *prefix)
+{
+  FORT_MOD_NAME(p3dfft_trace_dump)(prefix);
+}
+
+inline void Cp3dfft_bench_kernels(int nx,int ny,int nz,int *dims,int nv,int nrep,int *blocks,int nblocks)
+{
+  FORT_MOD_NAME(p3dfft_bench_kernels)(&nx,&ny,&nz,dims,&nv,&nrep,blocks,&nblocks);
+}
+
+inline void Cp3dfft_dryrun(int *dims,int nx,int ny,int nz,int nxc,int nyc,int nzc,int nv,double *pred)
+{
+  FORT_MOD_NAME(p3dfft_dryrun)(dims,&nx,&ny,&nz,&nxc,&nyc,&nzc,&nv,pred);
+}
+
+inline void Cp3dfft_set_model(double *par)
+{
+  FORT_MOD_NAME(p3dfft_set_model)(par);
+}
+
+inline void Cp3dfft_get_model(double *par)
+{
+  FORT_MOD_NAME(p3dfft_get_model)(par);
+}
+
+inline void Cp3dfft_fit_model(int n,double *pred,double *meas,double *par)
+{
+  FORT_MOD_NAME(p3dfft_fit_model)(&n,pred,meas,par);
+}
+
+inline void Cp3dfft_get_mem(long long *cur,long long *peak)
+{
+  FORT_MOD_NAME(p3dfft_get_mem)(cur,peak);
+}
+
+inline void Cp3dfft_reset_mem_peak()
+{
+  FORT_MOD_NAME(p3dfft_reset_mem_peak)();
+}
+
+inline void Cp3dfft_set_mem_limit(long long limit,int fail)
+{
+  FORT_MOD_NAME(p3dfft_set_mem_limit)(&limit,&fail);
+}
+
+inline void Cp3dfft_mem_print()
+{
+  FORT_MOD_NAME(p3dfft_mem_print)();
+}
+
 
 #ifndef SINGLE_PREC
 inline void Cp3dfft_ftran_r2c(double *A,double *B, unsigned char *op)
@@ -140,6 +463,256 @@ inline void Cp3dfft_btran_c2r(float *A,float *B, unsigned char *op)
 }
 #endif
 
+#ifndef SINGLE_PREC
+inline void Cp3dfft_btran_c2r_deriv(double *A,double *B, unsigned char *op, int idir)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2r_deriv)(A,B,op,&idir);
+}
+#else
+inline void Cp3dfft_btran_c2r_deriv(float *A,float *B, unsigned char *op, int idir)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2r_deriv)(A,B,op,&idir);
+}
+#endif
+
+#ifndef SINGLE_PREC
+inline void Cp3dfft_solve_helmholtz(double alpha,double beta,double *A,double *B)
+{
+  FORT_MOD_NAME(p3dfft_solve_helmholtz)(&alpha,&beta,A,B);
+}
+#else
+inline void Cp3dfft_solve_helmholtz(float alpha,float beta,float *A,float *B)
+{
+  FORT_MOD_NAME(p3dfft_solve_helmholtz)(&alpha,&beta,A,B);
+}
+#endif
+
+#ifndef SINGLE_PREC
+inline void Cp3dfft_convolve_many(double *A,int dim_in,int nin,double *B,int dim_out,int nout,
+		void (*prod)(int *n,int *nin,double *U,int *ldu,int *k,double *W), unsigned char *op)
+{
+  FORT_MOD_NAME(p3dfft_convolve_many)(A,&dim_in,&nin,B,&dim_out,&nout,prod,op);
+}
+#else
+inline void Cp3dfft_convolve_many(float *A,int dim_in,int nin,float *B,int dim_out,int nout,
+		void (*prod)(int *n,int *nin,float *U,int *ldu,int *k,float *W), unsigned char *op)
+{
+  FORT_MOD_NAME(p3dfft_convolve_many)(A,&dim_in,&nin,B,&dim_out,&nout,prod,op);
+}
+#endif
+
+#ifndef SINGLE_PREC
+inline void Cp3dfft_ftran_r2c_diag(double *A,double *B, unsigned char *op,int kmax,double *E,double *energy,double *maxabs,int *nnan)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2c_diag)(A,B,op,&kmax,E,energy,maxabs,nnan);
+}
+
+inline void Cp3dfft_spec_diag(double *B,int kmax,double *E,double *energy,double *maxabs,int *nnan)
+{
+  FORT_MOD_NAME(p3dfft_spec_diag)(B,&kmax,E,energy,maxabs,nnan);
+}
+
+inline void Cp3dfft_ftran_r2c_xy(double *A,double *B)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2c_xy)(A,B);
+}
+
+inline void Cp3dfft_btran_c2r_xy(double *A,double *B)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2r_xy)(A,B);
+}
+
+inline void Cp3dfft_ftran_c2c(double *A,double *B)
+{
+  FORT_MOD_NAME(p3dfft_ftran_c2c)(A,B);
+}
+
+inline void Cp3dfft_btran_c2c(double *A,double *B)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2c)(A,B);
+}
+
+inline void Cp3dfft_ftran_r2r_x(double *A,double *B, unsigned char *op)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2r_x)(A,B,op);
+}
+
+inline void Cp3dfft_btran_r2r_x(double *A,double *B, unsigned char *op)
+{
+  FORT_MOD_NAME(p3dfft_btran_r2r_x)(A,B,op);
+}
+
+inline void Cp3dfft_ghost_begin(double *A)
+{
+  FORT_MOD_NAME(p3dfft_ghost_begin)(A);
+}
+
+inline void Cp3dfft_ghost_end(double *A)
+{
+  FORT_MOD_NAME(p3dfft_ghost_end)(A);
+}
+
+inline void Cp3dfft_update_ghosts(double *A)
+{
+  FORT_MOD_NAME(p3dfft_update_ghosts)(A);
+}
+
+inline void Cp3dfft_gather_box(double *A,int *base,int *size,double *B,int recv)
+{
+  FORT_MOD_NAME(p3dfft_gather_box)(A,base,size,B,&recv);
+}
+
+inline void Cp3dfft_scatter_box(double *B,int *base,int *size,double *A,int root)
+{
+  FORT_MOD_NAME(p3dfft_scatter_box)(B,base,size,A,&root);
+}
+
+inline void Cp3dfft_gather_box_spec(double *A,int *base,int *size,double *B,int recv)
+{
+  FORT_MOD_NAME(p3dfft_gather_box_spec)(A,base,size,B,&recv);
+}
+
+inline void Cp3dfft_scatter_box_spec(double *B,int *base,int *size,double *A,int root)
+{
+  FORT_MOD_NAME(p3dfft_scatter_box_spec)(B,base,size,A,&root);
+}
+
+inline void Cp3dfft_write_ckpt(const char *fname,double *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_write_ckpt)(fname,A,&nv);
+}
+
+inline void Cp3dfft_read_ckpt(const char *fname,double *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_read_ckpt)(fname,A,&nv);
+}
+
+inline void Cp3dfft_write_ckpt_spec(const char *fname,double *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_write_ckpt_spec)(fname,A,&nv);
+}
+
+inline void Cp3dfft_read_ckpt_spec(const char *fname,double *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_read_ckpt_spec)(fname,A,&nv);
+}
+
+inline void Cp3dfft_write_ckpt_trunc(const char *fname,double *A,int nv,int *kmax,int k2max)
+{
+  FORT_MOD_NAME(p3dfft_write_ckpt_trunc)(fname,A,&nv,kmax,&k2max);
+}
+
+inline void Cp3dfft_read_ckpt_trunc(const char *fname,double *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_read_ckpt_trunc)(fname,A,&nv);
+}
+#else
+inline void Cp3dfft_ftran_r2c_diag(float *A,float *B, unsigned char *op,int kmax,double *E,double *energy,double *maxabs,int *nnan)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2c_diag)(A,B,op,&kmax,E,energy,maxabs,nnan);
+}
+
+inline void Cp3dfft_spec_diag(float *B,int kmax,double *E,double *energy,double *maxabs,int *nnan)
+{
+  FORT_MOD_NAME(p3dfft_spec_diag)(B,&kmax,E,energy,maxabs,nnan);
+}
+
+inline void Cp3dfft_ftran_r2c_xy(float *A,float *B)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2c_xy)(A,B);
+}
+
+inline void Cp3dfft_btran_c2r_xy(float *A,float *B)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2r_xy)(A,B);
+}
+
+inline void Cp3dfft_ftran_c2c(float *A,float *B)
+{
+  FORT_MOD_NAME(p3dfft_ftran_c2c)(A,B);
+}
+
+inline void Cp3dfft_btran_c2c(float *A,float *B)
+{
+  FORT_MOD_NAME(p3dfft_btran_c2c)(A,B);
+}
+
+inline void Cp3dfft_ftran_r2r_x(float *A,float *B, unsigned char *op)
+{
+  FORT_MOD_NAME(p3dfft_ftran_r2r_x)(A,B,op);
+}
+
+inline void Cp3dfft_btran_r2r_x(float *A,float *B, unsigned char *op)
+{
+  FORT_MOD_NAME(p3dfft_btran_r2r_x)(A,B,op);
+}
+
+inline void Cp3dfft_ghost_begin(float *A)
+{
+  FORT_MOD_NAME(p3dfft_ghost_begin)(A);
+}
+
+inline void Cp3dfft_ghost_end(float *A)
+{
+  FORT_MOD_NAME(p3dfft_ghost_end)(A);
+}
+
+inline void Cp3dfft_update_ghosts(float *A)
+{
+  FORT_MOD_NAME(p3dfft_update_ghosts)(A);
+}
+
+inline void Cp3dfft_gather_box(float *A,int *base,int *size,float *B,int recv)
+{
+  FORT_MOD_NAME(p3dfft_gather_box)(A,base,size,B,&recv);
+}
+
+inline void Cp3dfft_scatter_box(float *B,int *base,int *size,float *A,int root)
+{
+  FORT_MOD_NAME(p3dfft_scatter_box)(B,base,size,A,&root);
+}
+
+inline void Cp3dfft_gather_box_spec(float *A,int *base,int *size,float *B,int recv)
+{
+  FORT_MOD_NAME(p3dfft_gather_box_spec)(A,base,size,B,&recv);
+}
+
+inline void Cp3dfft_scatter_box_spec(float *B,int *base,int *size,float *A,int root)
+{
+  FORT_MOD_NAME(p3dfft_scatter_box_spec)(B,base,size,A,&root);
+}
+
+inline void Cp3dfft_write_ckpt(const char *fname,float *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_write_ckpt)(fname,A,&nv);
+}
+
+inline void Cp3dfft_read_ckpt(const char *fname,float *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_read_ckpt)(fname,A,&nv);
+}
+
+inline void Cp3dfft_write_ckpt_spec(const char *fname,float *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_write_ckpt_spec)(fname,A,&nv);
+}
+
+inline void Cp3dfft_read_ckpt_spec(const char *fname,float *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_read_ckpt_spec)(fname,A,&nv);
+}
+
+inline void Cp3dfft_write_ckpt_trunc(const char *fname,float *A,int nv,int *kmax,int k2max)
+{
+  FORT_MOD_NAME(p3dfft_write_ckpt_trunc)(fname,A,&nv,kmax,&k2max);
+}
+
+inline void Cp3dfft_read_ckpt_trunc(const char *fname,float *A,int nv)
+{
+  FORT_MOD_NAME(p3dfft_read_ckpt_trunc)(fname,A,&nv);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif